@@ -0,0 +1,99 @@
+#!/bin/sh
+
+# Banco de pruebas de los generadores de cadenas.
+
+# Genera con mapgen mapas sintéticos de varias escalas y ejecuta sobre cada
+# uno los programas main-*-gen con la opción --stats en varios niveles y
+# profundidades. El reporte de cada ejecución se escribe en la salida
+# estándar precedido por la escala del mapa y la línea de comandos.
+
+# Uso: ./bench.sh [ESCALA ...]
+
+# Cada ESCALA es la cantidad de unidades económicas de un mapa. Por omisión
+# se usan 1000, 10000 y 50000. Las variables de entorno SUB_UES, PRODUCTS,
+# INPUTS y TRADES se pasan a mapgen; BENCH_DIR indica el directorio donde
+# se guardan los mapas y las cadenas (por omisión bench-out).
+
+# Copyright (C) 2017 Corporación de Desarrollo de la Región Los Andes.
+
+# Autor: Alejandro J. Mujica (aledrums en gmail punto com)
+
+# Este programa es software libre; Usted puede usarlo bajo los términos de la
+# licencia de software GPL versión 2.0 de la Free Software Foundation.
+
+# Este programa se distribuye con la esperanza de que sea útil, pero SIN
+# NINGUNA GARANTÍA; tampoco las implícitas garantías de MERCANTILIDAD o
+# ADECUACIÓN A UN PROPÓSITO PARTICULAR.
+# Consulte la licencia GPL para más detalles. Usted debe recibir una copia
+# de la GPL junto con este programa; si no, escriba a la Free Software
+# Foundation Inc. 51 Franklin Street,5 Piso, Boston, MA 02110-1301, USA.
+
+set -e
+
+SCALES=${*:-"1000 10000 50000"}
+SUB_UES=${SUB_UES:-3}
+PRODUCTS=${PRODUCTS:-4}
+INPUTS=${INPUTS:-3}
+TRADES=${TRADES:-2}
+BENCH_DIR=${BENCH_DIR:-bench-out}
+
+FIRST_YEAR=2015
+YEAR=2016
+
+# Sin Graphviz se mide la cadena hasta el texto DOT.
+if command -v dot > /dev/null 2>&1
+then
+    EXT=svg
+else
+    EXT=dot
+fi
+
+mkdir -p "$BENCH_DIR"
+
+run()
+{
+    out="$BENCH_DIR/$1.$EXT"
+    shift
+    echo "== $*"
+    "$@" -y $YEAR -i "$MAP" -o "$out" --stats | sed -n '/^Phase/,$p'
+    echo
+}
+
+for scale in $SCALES
+do
+    MAP="$BENCH_DIR/map-$scale.bin"
+
+    echo "######## $scale unidades económicas"
+
+    ./mapgen -u $scale -S $SUB_UES -p $PRODUCTS -n $INPUTS -T $TRADES \
+	     -y $FIRST_YEAR -Y 2 -r 1 -o "$MAP"
+
+    # Se mide primero una carga para que las demás encuentren el índice de
+    # comercio (.idx) construido.
+    run warmup ./main-ue-gen -r J100000
+
+    for level in seccion:A division:A0 grupo:A00 clase:A000 rama:A0000
+    do
+	run caev-${level%%:*} ./main-caev-gen -l ${level%%:*} -c ${level#*:}
+    done
+
+    for level in seccion:0 capitulo:00 partida:000 subpartida:0000 \
+		 subsubpartida:00000
+    do
+	run tariffcode-ue-${level%%:*} \
+	    ./main-tariffcode-ue-gen -l ${level%%:*} -c ${level#*:}
+	run tariffcode-product-${level%%:*} \
+	    ./main-tariffcode-product-gen -l ${level%%:*} -c ${level#*:}
+    done
+
+    run ue ./main-ue-gen -r J100000
+
+    for depth in 1 3 5
+    do
+	for distance in 0 10
+	do
+	    run product-$depth-$distance \
+		./main-product-gen -p 1 -u $depth -d $depth -e $distance
+	done
+    done
+done